@@ -10,8 +10,10 @@
 
 #include <Windows.h>
 #include <iostream>
+#include <string>
 #include "console/page/header/page.h"
 #include "cmd-dispatcher/header/CmdDispatcher.h"
+#include "input-parser/header/InputParser.h"
 
 void performPreChecks(std::ostream&);
 void postLaunchWarnings(std::ostream&, std::ostream&, HANDLE);
@@ -48,12 +50,17 @@ int main() {
     initPage(rOutputStream, hConsole);
 
     CmdDispatcher& cmdDispatcher = CmdDispatcher::getInstance();
+    InputParser inputParser;
 
-    // REPL
+    // REPL, one line at a time so commands can take arguments
     std::string input;
-    while (true) {
-        std::cin >> input;
-        cmdDispatcher.dispatch(input);
+    while (std::getline(rInputStream, input)) {
+        if (!inputParser.parse(input, rErrorStream)) {
+            continue;
+        }
+        for (const ParsedCommand& rCommand : inputParser.getCommands()) {
+            cmdDispatcher.dispatch(rCommand);
+        }
     }
 
     return 0;
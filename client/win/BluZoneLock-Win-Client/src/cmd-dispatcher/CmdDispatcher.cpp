@@ -10,7 +10,11 @@
 #include <string>
 #include <list>
 #include <algorithm>
+#include <string_view>
+#include <Windows.h>
 #include "header/CmdDispatcher.h"
+#include "../console/page/header/page.h"
+#include "../input-parser/header/InputParser.h"
 
 CmdDispatcher::CmdDispatcher() {
 	initCoreCommands();
@@ -25,22 +29,31 @@ CmdDispatcher& CmdDispatcher::getInstance() {
 	return instance;
 }
 
-void CmdDispatcher::dispatch(std::string input) {
+void CmdDispatcher::dispatch(const ParsedCommand& rCommand) {
+	std::string_view name = rCommand.name;
+
 	// check if the command exists
-	auto it = std::find(allCmds.begin(), allCmds.end(), input);
+	auto it = std::find(allCmds.begin(), allCmds.end(), name);
 	if (it != allCmds.end()) {
-		if (input == "connect") {
-			// connectCommand.act();
+		if (name == "connect") {
+			// connectCommand.act(rCommand.pArgs, rCommand.argCount);
 		}
-		else if(input == "status") {
-			// statusCommand.act();
+		else if(name == "status") {
+			writeSignalHistory(std::cout, GetStdHandle(STD_OUTPUT_HANDLE));
 		}
-		else if(input == "disconnect") {
+		else if(name == "disconnect") {
 			// disconnectCommand.act();
 		}
-		else if (input == "exit") {
+		else if (name == "exit") {
 			// exitCommand.act();
 		}
+		else if (name == "source") {
+			if (rCommand.argCount != 1) {
+				std::cerr << "usage: source <file>" << std::endl;
+				return;
+			}
+			InputParser::runScript(std::string(rCommand.pArgs[0]), std::cerr);
+		}
 	}
 }
 
@@ -49,4 +62,5 @@ void CmdDispatcher::initCoreCommands() {
 	allCmds.push_back("status");
 	allCmds.push_back("disconnect");
 	allCmds.push_back("exit");
+	allCmds.push_back("source");
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <string>
 #include <list>
 #include <algorithm>
+#include "../../input-parser/header/InputParser.h"
 
 class CmdDispatcher {
 	public:
@@ -21,7 +22,7 @@ class CmdDispatcher {
 		CmdDispatcher(const CmdDispatcher&) = delete;
 		CmdDispatcher& operator=(const CmdDispatcher&) = delete;
 
-		void dispatch(std::string input);
+		void dispatch(const ParsedCommand& rCommand);
 	private:
 		~CmdDispatcher();
 		CmdDispatcher();
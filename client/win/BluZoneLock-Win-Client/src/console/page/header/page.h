@@ -18,4 +18,13 @@
 
 void writeTitle(std::ostream& rOutputStream, HANDLE hConsole);
 
-void initPage(std::ostream& rOutputStream, HANDLE hConsole);
\ No newline at end of file
+void initPage(std::ostream& rOutputStream, HANDLE hConsole);
+
+/**
+* @brief Writes a sparkline plus min/max/mean of the last minute, hour and day for
+* every device tracked by `SignalHistory`.
+*
+* @param rOutputStream A reference to `std::ostream`
+* @param hConsole A HANDLE to the console.
+*/
+void writeSignalHistory(std::ostream& rOutputStream, HANDLE hConsole);
\ No newline at end of file
@@ -10,6 +10,20 @@
 #include <iostream>
 #include <stdint.h>
 #include "../utils/header/Utils.h"
+#include "../../signal-history/header/SignalHistory.h"
+
+// Characters used for sparklines, weakest signal first
+static const char SPARKLINE_RAMP[] = "_.-~=+*#";
+static const int SPARKLINE_RAMP_LENGTH = sizeof(SPARKLINE_RAMP) - 1;
+// RSSI range (dBm) mapped onto the sparkline ramp
+static const int SPARKLINE_RSSI_FLOOR = -100;
+static const int SPARKLINE_RSSI_CEIL = -30;
+
+static std::string formatDeviceAddress(uint64_t address);
+static void writeSignalRow(
+	std::string label, uint64_t address, SignalResolution resolution, uint64_t now,
+	std::ostream& rOutputStream, HANDLE hConsole
+);
 
 void writeTitle(std::ostream& rOutputStream, HANDLE hConsole) {
 
@@ -56,4 +70,91 @@ void initPage(std::ostream& rOutputStream, HANDLE hConsole) {
 	printInRGB(time, true, 0, 255, 255, false, false, true, 0, hConsole, rOutputStream);
 
 	rOutputStream << "" << std::endl << std::flush;
+
+	// signal history only belongs on the page once the Bluetooth layer has fed samples
+	uint64_t address;
+	if (SignalHistory::getInstance().getDeviceAddresses(&address, 1) != 0) {
+		writeSignalHistory(rOutputStream, hConsole);
+	}
+}
+
+void writeSignalHistory(std::ostream& rOutputStream, HANDLE hConsole) {
+	SignalHistory& signalHistory = SignalHistory::getInstance();
+
+	uint64_t addresses[SIGNAL_HISTORY_MAX_DEVICES];
+	size_t deviceCount = signalHistory.getDeviceAddresses(addresses, SIGNAL_HISTORY_MAX_DEVICES);
+
+	if (deviceCount == 0) {
+		printInRGB("No devices tracked", true, 128, 128, 128, true, true, true, 0, hConsole, rOutputStream);
+		return;
+	}
+
+	uint64_t now = SignalHistory::nowSeconds();
+	for (size_t i = 0; i < deviceCount; i++) {
+		printInRGB(formatDeviceAddress(addresses[i]), true, 173, 216, 230, true, false, true, 0, hConsole, rOutputStream);
+		writeSignalRow("1m ", addresses[i], SignalResolution::LAST_MINUTE, now, rOutputStream, hConsole);
+		writeSignalRow("1h ", addresses[i], SignalResolution::LAST_HOUR, now, rOutputStream, hConsole);
+		writeSignalRow("1d ", addresses[i], SignalResolution::LAST_DAY, now, rOutputStream, hConsole);
+	}
+	rOutputStream.flush();
+}
+
+/**
+* @brief Formats a 48-bit Bluetooth address as `XX:XX:XX:XX:XX:XX`.
+*/
+static std::string formatDeviceAddress(uint64_t address) {
+	static const char HEX_DIGITS[] = "0123456789ABCDEF";
+	std::string formatted;
+	for (int shift = 40; shift >= 0; shift -= 8) {
+		unsigned int octet = (address >> shift) & 0xFF;
+		formatted += HEX_DIGITS[octet >> 4];
+		formatted += HEX_DIGITS[octet & 0xF];
+		if (shift != 0) {
+			formatted += ':';
+		}
+	}
+	return formatted;
+}
+
+/**
+* @brief Writes one sparkline row (label, per-bucket means, window min/max/mean) for a device.
+*/
+static void writeSignalRow(
+	std::string label, uint64_t address, SignalResolution resolution, uint64_t now,
+	std::ostream& rOutputStream, HANDLE hConsole
+) {
+	SignalHistory& signalHistory = SignalHistory::getInstance();
+
+	RssiBucket buckets[SignalHistory::DAY_BUCKETS];
+	size_t written = signalHistory.query(address, resolution, now, buckets, SignalHistory::DAY_BUCKETS);
+
+	// map every bucket mean onto the ramp, blank where there were no samples
+	std::string sparkline(written, ' ');
+	for (size_t i = 0; i < written; i++) {
+		if (buckets[i].count == 0) {
+			continue;
+		}
+		int level = static_cast<int>(
+			(buckets[i].mean() - SPARKLINE_RSSI_FLOOR) * SPARKLINE_RAMP_LENGTH /
+			(SPARKLINE_RSSI_CEIL - SPARKLINE_RSSI_FLOOR)
+		);
+		if (level < 0) level = 0;
+		if (level >= SPARKLINE_RAMP_LENGTH) level = SPARKLINE_RAMP_LENGTH - 1;
+		sparkline[i] = SPARKLINE_RAMP[level];
+	}
+
+	std::string summary;
+	RssiSummary total;
+	if (signalHistory.summarize(address, resolution, now, total)) {
+		summary = " min " + std::to_string(total.min) +
+			" max " + std::to_string(total.max) +
+			" mean " + std::to_string(static_cast<int>(total.mean)) + " dBm";
+	}
+	else {
+		summary = " no samples";
+	}
+
+	printInRGB(label, true, 128, 128, 128, false, false, true, 2, hConsole, rOutputStream);
+	printInRGB(sparkline, true, 0, 255, 255, false, false, true, 0, hConsole, rOutputStream);
+	printInRGB(summary, true, 233, 116, 81, true, false, true, 0, hConsole, rOutputStream);
 }
@@ -0,0 +1,191 @@
+/**
+ * @file InputParser.cpp
+ * @brief This file contains InputParser class implementation which splits
+ * user input and command scripts into commands for the command dispatcher.
+ *
+ * @author Rakesh Kumar
+ */
+
+#include <Windows.h>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "header/InputParser.h"
+#include "../cmd-dispatcher/header/CmdDispatcher.h"
+
+// How many `source` commands are currently being executed one inside another
+static int sourceDepth = 0;
+
+static bool isBlank(char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool isQuote(char c) {
+	return c == '"' || c == '\'';
+}
+
+static bool isTokenEnd(char c) {
+	return isBlank(c) || c == ';';
+}
+
+bool InputParser::parse(std::string_view line, std::ostream& rErrorStream) {
+	tokens.clear();
+	commandStarts.clear();
+	commands.clear();
+
+	commandStarts.push_back(0);
+
+	size_t i = 0;
+	while (i < line.size()) {
+		char c = line[i];
+
+		if (isBlank(c)) {
+			i++;
+		}
+		else if (c == ';') {
+			// close the current command unless it is empty (e.g. `;;`)
+			if (tokens.size() > commandStarts.back()) {
+				commandStarts.push_back(tokens.size());
+			}
+			i++;
+		}
+		else if (c == '#') {
+			// comment runs to the end of the line
+			break;
+		}
+		else if (isQuote(c)) {
+			size_t closing = line.find(c, i + 1);
+			if (closing == std::string_view::npos) {
+				rErrorStream << "Syntax error: unterminated quote at column " << i + 1 << std::endl;
+				tokens.clear();
+				commandStarts.clear();
+				return false;
+			}
+			// a quoted token must stand alone, e.g. `"AA BB"x` is rejected
+			if (closing + 1 < line.size() && !isTokenEnd(line[closing + 1])) {
+				rErrorStream << "Syntax error: unexpected character after quote at column "
+					<< closing + 2 << std::endl;
+				tokens.clear();
+				commandStarts.clear();
+				return false;
+			}
+			tokens.push_back(line.substr(i + 1, closing - i - 1));
+			i = closing + 1;
+		}
+		else {
+			size_t start = i;
+			while (i < line.size() && !isTokenEnd(line[i]) && !isQuote(line[i])) {
+				i++;
+			}
+			// a quote touching an unquoted run, e.g. `a"b c"`, is rejected
+			if (i < line.size() && isQuote(line[i])) {
+				rErrorStream << "Syntax error: unexpected quote at column " << i + 1 << std::endl;
+				tokens.clear();
+				commandStarts.clear();
+				return false;
+			}
+			tokens.push_back(line.substr(start, i - start));
+		}
+	}
+
+	if (tokens.size() > commandStarts.back()) {
+		commandStarts.push_back(tokens.size());
+	}
+
+	// `tokens` no longer grows, so pointers into it are stable from here on
+	for (size_t k = 0; k + 1 < commandStarts.size(); k++) {
+		size_t start = commandStarts[k];
+		ParsedCommand command;
+		command.name = tokens[start];
+		command.pArgs = tokens.data() + start + 1;
+		command.argCount = commandStarts[k + 1] - start - 1;
+		commands.push_back(command);
+	}
+
+	return true;
+}
+
+const std::vector<ParsedCommand>& InputParser::getCommands() const {
+	return commands;
+}
+
+bool InputParser::runScript(const std::string& path, std::ostream& rErrorStream) {
+	if (sourceDepth >= MAX_SOURCE_DEPTH) {
+		rErrorStream << "source: scripts nested deeper than " << MAX_SOURCE_DEPTH
+			<< " levels, skipping " << path << std::endl;
+		return false;
+	}
+
+	HANDLE hFile = CreateFileA(
+		path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+	);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		rErrorStream << "source: cannot open " << path << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(hFile, &fileSize)) {
+		rErrorStream << "source: cannot read size of " << path << std::endl;
+		CloseHandle(hFile);
+		return false;
+	}
+	if (fileSize.QuadPart == 0) {
+		// an empty file cannot be mapped, and there is nothing to run anyway
+		CloseHandle(hFile);
+		return true;
+	}
+
+	HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (hMapping == nullptr) {
+		rErrorStream << "source: cannot map " << path << std::endl;
+		CloseHandle(hFile);
+		return false;
+	}
+
+	const char* pView = static_cast<const char*>(MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+	if (pView == nullptr) {
+		rErrorStream << "source: cannot map " << path << std::endl;
+		CloseHandle(hMapping);
+		CloseHandle(hFile);
+		return false;
+	}
+
+	std::string_view script(pView, static_cast<size_t>(fileSize.QuadPart));
+	// skip the UTF-8 byte order mark many Windows editors write
+	if (script.substr(0, 3) == "\xEF\xBB\xBF") {
+		script.remove_prefix(3);
+	}
+	CmdDispatcher& cmdDispatcher = CmdDispatcher::getInstance();
+	InputParser parser;
+
+	sourceDepth++;
+
+	size_t lineNumber = 0;
+	size_t position = 0;
+	while (position < script.size()) {
+		size_t lineEnd = script.find('\n', position);
+		if (lineEnd == std::string_view::npos) {
+			lineEnd = script.size();
+		}
+		std::string_view line = script.substr(position, lineEnd - position);
+		position = lineEnd + 1;
+		lineNumber++;
+
+		if (!parser.parse(line, rErrorStream)) {
+			rErrorStream << "\tat " << path << ":" << lineNumber << std::endl;
+			continue;
+		}
+		for (const ParsedCommand& rCommand : parser.getCommands()) {
+			cmdDispatcher.dispatch(rCommand);
+		}
+	}
+
+	sourceDepth--;
+
+	UnmapViewOfFile(pView);
+	CloseHandle(hMapping);
+	CloseHandle(hFile);
+	return true;
+}
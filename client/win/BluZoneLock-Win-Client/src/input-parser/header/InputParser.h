@@ -0,0 +1,72 @@
+/**
+ * @file InputParser.h
+ * @brief This file contains InputParser class which splits a line of user
+ * input into commands and their arguments.
+ *
+ * Tokens are `std::string_view`s into the caller's line buffer, so nothing is
+ * copied while parsing. Tokens are separated by whitespace, `"..."` and `'...'`
+ * quote a token containing whitespace or `;`, `;` separates commands on one line
+ * and `#` at the start of a token comments out the rest of the line. A quoted token
+ * must stand alone: quotes touching other characters (`"a b"c`, `a"b"`) are a
+ * syntax error, since joining the pieces would need a copy.
+ *
+ * @author Rakesh Kumar
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+* @brief One command of a parsed line. All views point into the parsed line buffer
+* and stay valid until it is modified or the parser parses another line.
+*/
+struct ParsedCommand {
+	std::string_view name;
+	const std::string_view* pArgs;
+	size_t argCount;
+};
+
+class InputParser {
+	public:
+
+		/**
+		* @brief Tokenizes `line` into `;`-separated commands.
+		*
+		* Internal buffers are reused between calls, so parsing does not allocate once
+		* they have grown to fit the longest line seen.
+		*
+		* @param line -> The line to parse; must outlive the returned commands.
+		* @param rErrorStream -> A reference to the std::ostream used to report syntax errors.
+		*
+		* @return false on a syntax error, in which case no commands are available.
+		*/
+		bool parse(std::string_view line, std::ostream& rErrorStream);
+
+		const std::vector<ParsedCommand>& getCommands() const;
+
+		/**
+		* @brief Memory-maps a command script and dispatches every command in it.
+		*
+		* Lines are parsed straight out of the mapped view. A line with a syntax error is
+		* reported with its line number and skipped. Scripts may `source` other scripts
+		* up to `MAX_SOURCE_DEPTH` levels deep.
+		*
+		* @param path -> Path of the script.
+		* @param rErrorStream -> A reference to the std::ostream used to report errors.
+		*
+		* @return false if the script could not be opened or mapped.
+		*/
+		static bool runScript(const std::string& path, std::ostream& rErrorStream);
+
+		static constexpr int MAX_SOURCE_DEPTH = 8;
+	private:
+		std::vector<std::string_view> tokens;
+		// index into `tokens` of every command name, plus a trailing end marker
+		std::vector<size_t> commandStarts;
+		std::vector<ParsedCommand> commands;
+};
@@ -0,0 +1,250 @@
+/**
+ * @file SignalHistory.cpp
+ * @brief This file contains SignalHistory class implementation which keeps
+ * a fixed-size, multi-resolution history of RSSI samples per device.
+ *
+ * @author Rakesh Kumar
+ */
+
+#include <Windows.h>
+#include <cstring>
+#include <mutex>
+#include "header/SignalHistory.h"
+
+SignalHistory::SignalHistory() {
+	std::memset(devices, 0, sizeof(devices));
+}
+
+SignalHistory::~SignalHistory() {}
+
+SignalHistory& SignalHistory::getInstance() {
+	static SignalHistory instance;
+	return instance;
+}
+
+uint64_t SignalHistory::nowSeconds() {
+	return GetTickCount64() / 1000;
+}
+
+size_t SignalHistory::bucketCount(SignalResolution resolution) {
+	switch (resolution) {
+		case SignalResolution::LAST_MINUTE: return MINUTE_BUCKETS;
+		case SignalResolution::LAST_HOUR: return HOUR_BUCKETS;
+		default: return DAY_BUCKETS;
+	}
+}
+
+uint64_t SignalHistory::bucketWidthSeconds(SignalResolution resolution) {
+	switch (resolution) {
+		case SignalResolution::LAST_MINUTE: return 1;
+		case SignalResolution::LAST_HOUR: return 60;
+		default: return 15 * 60;
+	}
+}
+
+void SignalHistory::record(uint64_t deviceAddress, int8_t rssi) {
+	record(deviceAddress, rssi, nowSeconds());
+}
+
+void SignalHistory::record(uint64_t deviceAddress, int8_t rssi, uint64_t timestampSeconds) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	DeviceSeries& rSeries = acquireDevice(deviceAddress);
+	if (timestampSeconds > rSeries.lastUpdateSeconds) {
+		rSeries.lastUpdateSeconds = timestampSeconds;
+	}
+
+	// fold the sample into the current bucket of every resolution
+	const SignalResolution resolutions[] = {
+		SignalResolution::LAST_MINUTE, SignalResolution::LAST_HOUR, SignalResolution::LAST_DAY
+	};
+	for (SignalResolution resolution : resolutions) {
+		insertIntoRing(
+			rSeries.rings[static_cast<int>(resolution)],
+			bucketsOf(rSeries, resolution),
+			bucketCount(resolution),
+			timestampSeconds / bucketWidthSeconds(resolution),
+			rssi
+		);
+	}
+}
+
+size_t SignalHistory::query(
+	uint64_t deviceAddress, SignalResolution resolution, uint64_t nowSeconds,
+	RssiBucket* pOut, size_t capacity
+) const {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	const DeviceSeries* pSeries = findDevice(deviceAddress);
+	if (pSeries == nullptr) {
+		return 0;
+	}
+
+	const Ring& rRing = pSeries->rings[static_cast<int>(resolution)];
+	const RssiBucket* pBuckets = bucketsOf(*pSeries, resolution);
+	size_t count = bucketCount(resolution);
+	uint64_t nowEpoch = nowSeconds / bucketWidthSeconds(resolution);
+
+	// only the newest `capacity` buckets fit when the caller's array is short
+	size_t written = count < capacity ? count : capacity;
+	for (size_t i = 0; i < written; i++) {
+		RssiBucket& rOut = pOut[i];
+		std::memset(&rOut, 0, sizeof(rOut));
+
+		// epoch of the i-th bucket counted from the oldest one in the window
+		uint64_t offset = written - 1 - i;
+		if (offset > nowEpoch) {
+			continue;
+		}
+		uint64_t epoch = nowEpoch - offset;
+
+		if (rRing.hasData && epoch <= rRing.headEpoch && rRing.headEpoch - epoch < count) {
+			rOut = pBuckets[epoch % count];
+		}
+	}
+	return written;
+}
+
+bool SignalHistory::summarize(
+	uint64_t deviceAddress, SignalResolution resolution, uint64_t nowSeconds,
+	RssiSummary& rOut
+) const {
+	RssiBucket buckets[DAY_BUCKETS];
+	size_t written = query(deviceAddress, resolution, nowSeconds, buckets, DAY_BUCKETS);
+
+	std::memset(&rOut, 0, sizeof(rOut));
+	int64_t sum = 0;
+	for (size_t i = 0; i < written; i++) {
+		const RssiBucket& rBucket = buckets[i];
+		if (rBucket.count == 0) {
+			continue;
+		}
+		if (rOut.count == 0 || rBucket.min < rOut.min) {
+			rOut.min = rBucket.min;
+		}
+		if (rOut.count == 0 || rBucket.max > rOut.max) {
+			rOut.max = rBucket.max;
+		}
+		rOut.count += rBucket.count;
+		sum += rBucket.sum;
+	}
+
+	if (rOut.count == 0) {
+		return false;
+	}
+	rOut.mean = static_cast<double>(sum) / static_cast<double>(rOut.count);
+	return true;
+}
+
+size_t SignalHistory::getDeviceAddresses(uint64_t* pOut, size_t capacity) const {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	size_t written = 0;
+	for (const DeviceSeries& rSeries : devices) {
+		if (written == capacity) {
+			break;
+		}
+		if (rSeries.inUse) {
+			pOut[written++] = rSeries.address;
+		}
+	}
+	return written;
+}
+
+SignalHistory::DeviceSeries* SignalHistory::findDevice(uint64_t deviceAddress) {
+	for (DeviceSeries& rSeries : devices) {
+		if (rSeries.inUse && rSeries.address == deviceAddress) {
+			return &rSeries;
+		}
+	}
+	return nullptr;
+}
+
+const SignalHistory::DeviceSeries* SignalHistory::findDevice(uint64_t deviceAddress) const {
+	for (const DeviceSeries& rSeries : devices) {
+		if (rSeries.inUse && rSeries.address == deviceAddress) {
+			return &rSeries;
+		}
+	}
+	return nullptr;
+}
+
+SignalHistory::DeviceSeries& SignalHistory::acquireDevice(uint64_t deviceAddress) {
+	DeviceSeries* pSeries = findDevice(deviceAddress);
+	if (pSeries != nullptr) {
+		return *pSeries;
+	}
+
+	// take a free slot, otherwise evict the device updated least recently
+	DeviceSeries* pVictim = &devices[0];
+	for (DeviceSeries& rSeries : devices) {
+		if (!rSeries.inUse) {
+			pVictim = &rSeries;
+			break;
+		}
+		if (rSeries.lastUpdateSeconds < pVictim->lastUpdateSeconds) {
+			pVictim = &rSeries;
+		}
+	}
+
+	std::memset(pVictim, 0, sizeof(DeviceSeries));
+	pVictim->address = deviceAddress;
+	pVictim->inUse = true;
+	return *pVictim;
+}
+
+RssiBucket* SignalHistory::bucketsOf(DeviceSeries& rSeries, SignalResolution resolution) {
+	switch (resolution) {
+		case SignalResolution::LAST_MINUTE: return rSeries.minuteBuckets;
+		case SignalResolution::LAST_HOUR: return rSeries.hourBuckets;
+		default: return rSeries.dayBuckets;
+	}
+}
+
+const RssiBucket* SignalHistory::bucketsOf(const DeviceSeries& rSeries, SignalResolution resolution) {
+	switch (resolution) {
+		case SignalResolution::LAST_MINUTE: return rSeries.minuteBuckets;
+		case SignalResolution::LAST_HOUR: return rSeries.hourBuckets;
+		default: return rSeries.dayBuckets;
+	}
+}
+
+void SignalHistory::insertIntoRing(
+	Ring& rRing, RssiBucket* pBuckets, size_t capacity, uint64_t epoch, int8_t rssi
+) {
+	if (!rRing.hasData) {
+		rRing.headEpoch = epoch;
+		rRing.hasData = true;
+	}
+	else if (epoch > rRing.headEpoch) {
+		// clear the buckets skipped since the last sample; a gap longer than
+		// the ring wipes it once, so the cost stays bounded by its capacity
+		uint64_t steps = epoch - rRing.headEpoch;
+		if (steps >= capacity) {
+			std::memset(pBuckets, 0, capacity * sizeof(RssiBucket));
+		}
+		else {
+			for (uint64_t e = rRing.headEpoch + 1; e <= epoch; e++) {
+				std::memset(&pBuckets[e % capacity], 0, sizeof(RssiBucket));
+			}
+		}
+		rRing.headEpoch = epoch;
+	}
+	else if (rRing.headEpoch - epoch >= capacity) {
+		// older than the window this ring covers
+		return;
+	}
+
+	RssiBucket& rBucket = pBuckets[epoch % capacity];
+	if (rBucket.count == UINT16_MAX) {
+		return;
+	}
+	if (rBucket.count == 0 || rssi < rBucket.min) {
+		rBucket.min = rssi;
+	}
+	if (rBucket.count == 0 || rssi > rBucket.max) {
+		rBucket.max = rssi;
+	}
+	rBucket.sum += rssi;
+	rBucket.count++;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file SignalHistory.h
+ * @brief This file contains SignalHistory class which keeps a fixed-size,
+ * multi-resolution history of RSSI samples for every tracked device.
+ *
+ * Every device owns one contiguous block holding three ring buffers:
+ * the last minute at one second per bucket, the last hour at one minute
+ * per bucket and the last day at fifteen minutes per bucket. A sample is
+ * folded into the current bucket of each ring on insert, so min/max/mean
+ * are always up to date and memory never grows with uptime.
+ *
+ * @author Rakesh Kumar
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#ifndef SIGNAL_HISTORY_MAX_DEVICES
+#define SIGNAL_HISTORY_MAX_DEVICES 8
+#endif
+
+/**
+* @brief Aggregate of all RSSI samples which fell into one bucket.
+*
+* A bucket with `count == 0` holds no samples and its other fields are meaningless.
+*/
+struct RssiBucket {
+	int8_t min;
+	int8_t max;
+	uint16_t count;
+	int32_t sum;
+
+	double mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / count; }
+};
+
+/**
+* @brief Roll-up of every bucket in one window. Counted in wide types since a day at
+* full rate holds far more samples than a single bucket can.
+*/
+struct RssiSummary {
+	int8_t min;
+	int8_t max;
+	uint64_t count;
+	double mean;
+};
+
+/**
+* @brief Resolutions at which the history can be queried.
+*/
+enum class SignalResolution {
+	LAST_MINUTE,	// 60 buckets of 1 second
+	LAST_HOUR,		// 60 buckets of 1 minute
+	LAST_DAY		// 96 buckets of 15 minutes
+};
+
+class SignalHistory {
+	public:
+
+		static constexpr size_t MINUTE_BUCKETS = 60;
+		static constexpr size_t HOUR_BUCKETS = 60;
+		static constexpr size_t DAY_BUCKETS = 96;
+
+		static SignalHistory& getInstance();
+
+		SignalHistory(const SignalHistory&) = delete;
+		SignalHistory& operator=(const SignalHistory&) = delete;
+
+		/**
+		* @brief Records one RSSI sample for a device.
+		*
+		* If the device is not tracked yet and all slots are taken, the device which was
+		* updated least recently is evicted to make room.
+		*
+		* @param deviceAddress -> Bluetooth address of the device.
+		* @param rssi -> Received signal strength in dBm.
+		* @param timestampSeconds -> Monotonic time of the sample in seconds.
+		*/
+		void record(uint64_t deviceAddress, int8_t rssi, uint64_t timestampSeconds);
+
+		/**
+		* @brief Records one RSSI sample for a device, stamped with the current tick count.
+		*/
+		void record(uint64_t deviceAddress, int8_t rssi);
+
+		/**
+		* @brief Copies the buckets of one resolution into `pOut`, oldest first.
+		*
+		* The newest bucket is the one containing `nowSeconds`; buckets without samples are
+		* returned with `count == 0`.
+		*
+		* @param deviceAddress -> Bluetooth address of the device.
+		* @param resolution -> Which ring buffer to read.
+		* @param nowSeconds -> Monotonic time in seconds which ends the queried window.
+		* @param pOut -> Destination array.
+		* @param capacity -> Number of elements available in `pOut`.
+		*
+		* @return Number of buckets written, 0 if the device is not tracked.
+		*/
+		size_t query(
+			uint64_t deviceAddress, SignalResolution resolution, uint64_t nowSeconds,
+			RssiBucket* pOut, size_t capacity
+		) const;
+
+		/**
+		* @brief Rolls up every bucket of one resolution into a single aggregate.
+		*
+		* @return false if the device is not tracked or has no samples in the window.
+		*/
+		bool summarize(
+			uint64_t deviceAddress, SignalResolution resolution, uint64_t nowSeconds,
+			RssiSummary& rOut
+		) const;
+
+		/**
+		* @brief Copies the addresses of all tracked devices into `pOut`.
+		*
+		* @return Number of addresses written.
+		*/
+		size_t getDeviceAddresses(uint64_t* pOut, size_t capacity) const;
+
+		/**
+		* @brief Current monotonic time in seconds, on the same clock used by `record`.
+		*/
+		static uint64_t nowSeconds();
+
+		static size_t bucketCount(SignalResolution resolution);
+		static uint64_t bucketWidthSeconds(SignalResolution resolution);
+	private:
+		SignalHistory();
+		~SignalHistory();
+
+		/**
+		* @brief Ring buffer position of one resolution; the bucket for epoch `e` lives at
+		* index `e % capacity`, `headEpoch` is the newest epoch written so far.
+		*/
+		struct Ring {
+			uint64_t headEpoch;
+			bool hasData;
+		};
+
+		/**
+		* @brief All history of a single device, laid out in one contiguous block.
+		*/
+		struct DeviceSeries {
+			uint64_t address;
+			uint64_t lastUpdateSeconds;
+			bool inUse;
+			Ring rings[3];
+			RssiBucket minuteBuckets[MINUTE_BUCKETS];
+			RssiBucket hourBuckets[HOUR_BUCKETS];
+			RssiBucket dayBuckets[DAY_BUCKETS];
+		};
+
+		DeviceSeries devices[SIGNAL_HISTORY_MAX_DEVICES];
+		mutable std::mutex mutex;
+
+		DeviceSeries* findDevice(uint64_t deviceAddress);
+		const DeviceSeries* findDevice(uint64_t deviceAddress) const;
+		DeviceSeries& acquireDevice(uint64_t deviceAddress);
+
+		static RssiBucket* bucketsOf(DeviceSeries& rSeries, SignalResolution resolution);
+		static const RssiBucket* bucketsOf(const DeviceSeries& rSeries, SignalResolution resolution);
+		static void insertIntoRing(
+			Ring& rRing, RssiBucket* pBuckets, size_t capacity, uint64_t epoch, int8_t rssi
+		);
+};